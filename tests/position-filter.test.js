@@ -0,0 +1,85 @@
+// Checks the ingest position filter in index.html against single-fix GPS spikes
+// and against real moves such as pulling away from a parked spot.
+// Run with: node tests/position-filter.test.js
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const html = fs.readFileSync(path.join(__dirname, '..', 'index.html'), 'utf8');
+const scripts = [...html.matchAll(/<script>([\s\S]*?)<\/script>/g)].map(m => m[1]);
+const dashboard = scripts.reduce((a, b) => (b.length > a.length ? b : a));
+
+global.window = { location: { search: '' } };
+global.document = { addEventListener() {} };
+global.localStorage = { getItem() { return null; }, setItem() {}, removeItem() {} };
+(0, eval)(`${dashboard}\n;globalThis.dashboard = { createColumns, appendFeed, METERS_PER_DEGREE };`);
+const { createColumns, appendFeed, METERS_PER_DEGREE } = globalThis.dashboard;
+
+const BASE_LAT = -26.2041;
+const BASE_LNG = 28.0473;
+const T0 = Date.UTC(2026, 0, 1);
+
+function feed(k, dtSec, northM) {
+  return {
+    created_at: new Date(T0 + k * dtSec * 1000).toISOString(),
+    entry_id: k + 1,
+    field1: String(BASE_LAT + northM / METERS_PER_DEGREE),
+    field2: String(BASE_LNG),
+    field3: '0',
+    field4: '1'
+  };
+}
+
+// A parked vehicle reports steady fixes, then one spike, then steady fixes again
+function parkedWithSpike(steady, spikeM, dtSec) {
+  const cols = createColumns(400);
+  for (let k = 0; k < steady + 5; k++) appendFeed(cols, feed(k, dtSec, k === steady ? spikeM : 0));
+  return cols;
+}
+
+for (const [spikeM, dtSec] of [[300, 15], [500, 15], [1000, 30]]) {
+  const cols = parkedWithSpike(30, spikeM, dtSec);
+  const before = 29;
+  const spike = 30;
+  assert.strictEqual(cols.outlier[spike], 1, `${spikeM} m spike at ${dtSec} s should be flagged`);
+  assert.strictEqual(cols.sLat[spike], cols.sLat[before], `${spikeM} m spike at ${dtSec} s moved sLat`);
+  assert.strictEqual(cols.sLng[spike], cols.sLng[before], `${spikeM} m spike at ${dtSec} s moved sLng`);
+  for (let i = spike + 1; i < cols.length; i++) {
+    assert.strictEqual(cols.outlier[i], 0, `fix ${i} after the spike should be accepted`);
+    assert.ok(Math.abs(cols.sLat[i] - BASE_LAT) * METERS_PER_DEGREE < 5, `fix ${i} after the spike drifted`);
+  }
+}
+
+// A vehicle driving north at 15 m/s with 15 s fixes is never flagged
+{
+  const cols = createColumns(400);
+  for (let k = 0; k < 20; k++) appendFeed(cols, feed(k, 15, k * 225));
+  for (let i = 0; i < cols.length; i++) assert.strictEqual(cols.outlier[i], 0, `moving fix ${i} was flagged`);
+}
+
+// A vehicle parked for a while, then pulling away at accelM2 up to 25 m/s, may have
+// one fix held for confirmation but none rejected, and the track keeps up
+function northAt(tSec, accelM2) {
+  const tTop = 25 / accelM2;
+  return tSec <= tTop ? accelM2 * tSec * tSec / 2 : 25 * tTop / 2 + 25 * (tSec - tTop);
+}
+
+for (const [accelM2, dtSec] of [[2.5, 15], [3, 10], [1, 5], [1.5, 5]]) {
+  const cols = createColumns(400);
+  const parked = 20;
+  for (let k = 0; k < parked + 15; k++) {
+    appendFeed(cols, feed(k, dtSec, k < parked ? 0 : northAt((k - parked + 1) * dtSec, accelM2)));
+  }
+  let held = 0;
+  for (let i = 0; i < cols.length; i++) {
+    assert.notStrictEqual(cols.outlier[i], 1, `pull-away at ${accelM2} m/s² / ${dtSec} s rejected fix ${i}`);
+    if (cols.outlier[i] !== 0) held++;
+  }
+  assert.strictEqual(held, 0, `pull-away at ${accelM2} m/s² / ${dtSec} s left fixes unconfirmed`);
+  const last = cols.length - 1;
+  const trueM = northAt((last - parked + 1) * dtSec, accelM2);
+  const errM = Math.abs((cols.sLat[last] - BASE_LAT) * METERS_PER_DEGREE - trueM);
+  assert.ok(errM < 30, `pull-away at ${accelM2} m/s² / ${dtSec} s track is ${errM.toFixed(0)} m behind`);
+}
+
+console.log('position filter: ok');